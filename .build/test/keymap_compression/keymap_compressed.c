@@ -0,0 +1,39 @@
+/* Generated by util/compress_keymap.py from keyboards/nk65/keymaps/default/keymap.c, do not edit. */
+/* 300 keys, 128 not transparent: 370 bytes instead of 600 */
+
+#include "keymap.h"
+
+const uint16_t keymap_key_count = 300;
+
+const uint8_t keymap_chunk_bits[] PROGMEM = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0x80, 0xE0, 0x21, 0xFE, 0x8F, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+    0x10, 0x00, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x20, 0x00, 0x80, 0x00, 0x00,
+    0x37, 0x00,
+};
+
+const uint16_t keymap_chunk_base[] PROGMEM = {
+    0, 8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88,
+    89, 90, 93, 95, 102, 107, 114, 114, 114, 114, 114, 115,
+    115, 116, 116, 119, 121, 121, 121, 121, 122, 122, 123, 123,
+    123, 128,
+};
+
+const uint16_t keymap_keys[] PROGMEM = {
+    0x5C16, 0x001E, 0x001F, 0x0020, 0x0021, 0x0022, 0x0023, 0x0024,
+    0x0025, 0x0026, 0x0027, 0x002D, 0x002E, 0x002A, 0x004A, 0x002B,
+    0x0014, 0x001A, 0x0008, 0x0015, 0x0017, 0x001C, 0x0018, 0x000C,
+    0x0012, 0x0013, 0x002F, 0x0030, 0x0000, 0x004B, 0x0039, 0x0004,
+    0x0016, 0x0007, 0x0009, 0x000A, 0x000B, 0x000D, 0x000E, 0x000F,
+    0x0033, 0x0034, 0x0031, 0x0028, 0x004E, 0x00E1, 0x0000, 0x001D,
+    0x001B, 0x0006, 0x0019, 0x0005, 0x0011, 0x0010, 0x0036, 0x0037,
+    0x0038, 0x00E5, 0x0052, 0x004D, 0x00E0, 0x00E3, 0x00E2, 0x0000,
+    0x0000, 0x0000, 0x002C, 0x0000, 0x0000, 0x00E6, 0x5101, 0x00E4,
+    0x0050, 0x0051, 0x004F, 0x0035, 0x003A, 0x003B, 0x003C, 0x003D,
+    0x003E, 0x003F, 0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045,
+    0x004C, 0x0000, 0x5F09, 0x5F08, 0x5F0D, 0x5F0C, 0x5C00, 0x0000,
+    0x5F03, 0x5F02, 0x5F07, 0x5F06, 0x5F0B, 0x5F0A, 0x5F01, 0x5F00,
+    0x5F05, 0x5F04, 0x00A9, 0x00AA, 0x00A8, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};